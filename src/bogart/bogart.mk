@@ -28,6 +28,7 @@ SOURCES  := bogart.C \
             AS_BAT_PromoteToSingleton.C \
             AS_BAT_ReadInfo.C \
             AS_BAT_SetParentAndHang.C \
+            AS_BAT_Snapshot.C \
             AS_BAT_SplitDiscontinuous.C \
             AS_BAT_TigGraph.C \
             AS_BAT_TigVector.C \
@@ -78,6 +78,7 @@ SOURCES      := utility/src/utility/runtime.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
+                stores/ovLineBatch.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -108,6 +109,7 @@ SOURCES      := utility/src/utility/runtime.C \
                 utgcns/libNDalign/NDalgorithm-reverse.C \
                 \
                 utgcns/libpbutgcns/AlnGraphBoost.C  \
+                utgcns/libpbutgcns/AlnGraphFlat.C  \
                 \
                 gfa/gfa.C \
                 gfa/bed.C
@@ -172,6 +174,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 overlapInCore/overlapImport.mk \
                 overlapInCore/overlapPair.mk \
                 overlapInCore/edalign.mk \
+                overlapInCore/hashProbeBenchmark.mk \
                 \
                 overlapInCore/liboverlap/prefixEditDistance-matchLimitGenerate.mk \
                 \
@@ -116,6 +116,7 @@ sub utgcns ($$$) {
     print F "  -edlib    \\\n"   if (getGlobal("canuIteration") >= 0);
     print F "  -utgcns \\\n"     if (getGlobal("cnsConsensus") eq "utgcns");
     print F "  -threads " . getGlobal("cnsThreads") . " \\\n";
+    print F "  -memory " . getGlobal("cnsMemory") . " \\\n";
     print F "&& \\\n";
     print F "mv ./\${tag}cns/\$jobid.cns.WORKING ./\${tag}cns/\$jobid.cns \\\n";
     print F "\n";
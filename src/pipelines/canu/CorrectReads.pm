@@ -197,6 +197,10 @@ sub buildCorrectionLayoutsConfigure ($) {
 
     print STDERR "-- Computing correction layouts.\n";
 
+    my $layThreads = getGlobal("corLayoutThreads");
+
+    $layThreads = getGlobal("executiveThreads")   if (!defined($layThreads));
+
     $cmd  = "$bin/generateCorrectionLayouts \\\n";
     $cmd .= "  -S ../$asm.seqStore \\\n";
     $cmd .= "  -O  ./$asm.ovlStore \\\n";
@@ -205,6 +209,7 @@ sub buildCorrectionLayoutsConfigure ($) {
     $cmd .= "  -eL " . getGlobal("corMinEvidenceLength") . " \\\n"  if (defined(getGlobal("corMinEvidenceLength")));
     $cmd .= "  -eE " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
     $cmd .= "  -eC " . getCorCov($asm, "Local") . " \\\n";
+    $cmd .= "  -t  $layThreads \\\n";
     $cmd .= "> ./$asm.corStore.err 2>&1";
 
     if (runCommand($base, $cmd)) {
@@ -372,6 +377,8 @@ sub generateCorrectedReadsConfigure ($) {
     print F "  -ol " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -p ./correctReadsPartition.WORKING \\\n";
     print F "&& \\\n";
+    print F "mv ./correctReadsPartition.WORKING.plan ./correctReadsPartition.plan \\\n";
+    print F "&& \\\n";
     print F "mv ./correctReadsPartition.WORKING.batches ./correctReadsPartition.batches \\\n";
     print F "&& \\\n";
     print F "exit 0\n";
@@ -399,11 +406,14 @@ sub generateCorrectedReadsConfigure ($) {
         caExit("failed to partition reads for correction", "$path/correctReadsPartition.err");
     }
 
+    stashFile("$path/correctReadsPartition.plan");
     stashFile("$path/correctReadsPartition.batches");
     unlink("$path/correctReadsPartition.err");
 
     #  Generate a script for computing corrected reads, using the batches file
-    #  as a template.
+    #  as a template.  Each job corrects the reads listed for its batch in the
+    #  plan file, using the number of threads the batches file says fit in
+    #  memory.
 
     open(F, "> $path/correctReads.sh") or caExit("can't open '$path/correctReads.sh' for writing: $!", undef);
 
@@ -415,8 +425,7 @@ sub generateCorrectedReadsConfigure ($) {
     print F "\n";
     print F getJobIDShellCode();
     print F "\n";
-    print F "bgnid=0\n";
-    print F "endid=0\n";
+    print F "threads=" . getGlobal("corThreads") . "\n";
     print F "\n";
 
     my $nJobs = 0;
@@ -428,12 +437,11 @@ sub generateCorrectedReadsConfigure ($) {
         s/^\s+//;
         s/\s+$//;
 
-        my ($jobID, $bgnID, $endID, $nReads, $mem) = split '\s+', $_;
+        my ($jobID, $bgnID, $endID, $nReads, $mem, $threads) = split '\s+', $_;
 
         print  F "if [ \$jobid -eq $jobID ] ; then\n";
         printf F "  jobid=%04d\n", $jobID;   #  Parsed in Check() below.
-        print  F "  bgnid=$bgnID\n";
-        print  F "  endid=$endID\n";
+        print  F "  threads=$threads\n"   if (defined($threads));   #  Reads corrected at once that fit in memory.
         print  F "fi\n";
 
         $nJobs = $jobID;
@@ -441,7 +449,7 @@ sub generateCorrectedReadsConfigure ($) {
     close(B);
 
     print F "\n";
-    print F "if [ \$bgnid -eq 0 ]; then\n";
+    print F "if [ \$jobid -lt 1 -o \$jobid -gt $nJobs ]; then\n";
     print F "  echo Error: Invalid job \$jobid requested, must be between 1 and $nJobs.\n";
     print F "  exit 1\n";
     print F "fi\n";
@@ -462,7 +470,7 @@ sub generateCorrectedReadsConfigure ($) {
     print F "\n";
     print F fetchTigStoreShellCode("correction/2-correction", $asm, "corStore", "001", "");
     print F "\n";
-    print F fetchFileShellCode($path, "$asm.readsToCorrect", "");
+    print F fetchFileShellCode($path, "correctReadsPartition.plan", "");
     print F "\n";
 
     print F "seqStore=\"../../$asm.seqStore\"\n";
@@ -492,9 +500,8 @@ sub generateCorrectedReadsConfigure ($) {
     print F "\$bin/falconsense \\\n";
     print F "  -S \$seqStore \\\n";
     print F "  -C ../$asm.corStore \\\n";
-    print F "  -R ./$asm.readsToCorrect \\\n"                if ( fileExists("$path/$asm.readsToCorrect"));
-    print F "  -r \$bgnid-\$endid \\\n";
-    print F "  -t  " . getGlobal("corThreads") . " \\\n";
+    print F "  -B ./correctReadsPartition.plan \$jobid \\\n";
+    print F "  -t  \$threads \\\n";
     print F "  -cc " . getGlobal("corMinCoverage") . " \\\n";
     print F "  -cl " . getGlobal("minReadLength") . " \\\n";
     print F "  -oi " . getCorIdentity($asm) . " \\\n";
@@ -1009,6 +1009,8 @@ sub setDefaults () {
 
     #  ovbMemory and ovsMemory are set above.
 
+    setDefault("ovsCompress",       0,   "Compress overlap store files in blocks; smaller stores, slightly slower random access");
+
     #####  Executive
 
     setDefault("executiveMemory",   4,   "Amount of memory, in GB, to reserve for the Canu exective process");
@@ -1066,6 +1068,7 @@ sub setDefaults () {
     setDefault("corPartitionMin",              undef,        "Don't make a read correction partition with fewer than N reads");
     setDefault("corMinEvidenceLength",         undef,        "Limit read correction to only overlaps longer than this; default: unlimited");
     setDefault("corMaxEvidenceErate",          undef,        "Limit read correction to only overlaps at or below this fraction error; default: unlimited");
+    setDefault("corLayoutThreads",             undef,        "Number of threads to use when computing correction layouts; default: executiveThreads");
     setDefault("corMaxEvidenceCoverageGlobal", "1.0x",       "Limit reads used for correction to supporting at most this coverage; default: '1.0x' = 1.0 * estimated coverage");
     setDefault("corMaxEvidenceCoverageLocal",  "2.0x",       "Limit reads being corrected to at most this much evidence coverage; default: '2.0x' = 2.0 * estimated coverage");
     setDefault("corOutCoverage",               40,           "Only correct the longest reads up to this coverage; default 40");
@@ -607,6 +607,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "  -S ../../$asm.seqStore \\\n";
     print F "  -O ../$asm.ovlStore \\\n";
     print F "  -R \$minid \$maxid \\\n";
+    print F "  -t " . getGlobal("oeaThreads") . " \\\n";
     print F "  -e " . getGlobal("utgOvlErrorRate") . " -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -s \\\n"                                   if (defined(getGlobal("homoPolyCompress")));
     print F "  -c ./red.red \\\n";
@@ -407,6 +407,7 @@ sub mmapConfigure ($$$) {
     print F "  \$bin/mmapConvert \\\n";
     print F "    -S ../../$asm.seqStore \\\n";
     print F "    -o ./results/\$qry.mmap.ovb.WORKING \\\n";
+    print F "    -t " . getGlobal("${tag}mmapThreads") . " \\\n";
     print F "    -e " . getGlobal("${tag}OvlErrorRate");
     print F "    -partial \\\n"  if ($typ eq "partial");
     print F "    -len "  , getGlobal("minOverlapLength"),  " \\\n";
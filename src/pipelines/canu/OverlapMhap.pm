@@ -500,6 +500,7 @@ sub mhapConfigure ($$$) {
     print F "  \$bin/mhapConvert \\\n";
     print F "    -S ../../$asm.seqStore \\\n";
     print F "    -o ./results/\$qry.mhap.ovb.WORKING \\\n";
+    print F "    -t " . getGlobal("${tag}mhapThreads") . " \\\n";
     print F "    \$outPath/\$qry.mhap \\\n";
     print F "  && \\\n";
     print F "  mv ./results/\$qry.mhap.ovb.WORKING ./results/\$qry.mhap.ovb\n";
@@ -164,6 +164,8 @@ sub createOverlapStoreSequential ($$$) {
         print F " -O  ./$asm.ovlStore.BUILDING \\\n";
         print F" -S ../$asm.seqStore \\\n";
         print F " -C  ./$asm.ovlStore.config \\\n";
+        print F " -compress \\\n"   if (getGlobal("ovsCompress") == 1);
+        print F " -t  " . getGlobal("ovsThreads") . " \\\n";
         print F " > ./$asm.ovlStore.err 2>&1 \\\n";
         print F "&& \\\n";
         print F "mv ./$asm.ovlStore.BUILDING ./$asm.ovlStore\n";
@@ -384,7 +386,9 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -S ../$asm.seqStore \\\n";
         print F "  -C  ./$asm.ovlStore.config \\\n";
         print F "  -f \\\n";
+        print F "  -compress \\\n"   if (getGlobal("ovsCompress") == 1);
         print F "  -s \$jobid \\\n";
+        print F "  -t " . getGlobal("ovsThreads") . " \\\n";
         print F "  -M $sortMemory \n";
         print F "\n";
 